@@ -0,0 +1,69 @@
+#include "EnemyShipRegistry.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "EngineUtils.h"
+
+void UEnemyShipRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Ships spawned at runtime register themselves through this handler
+    ActorSpawnedHandle = GetWorld()->AddOnActorSpawnedHandler(
+        FOnActorSpawned::FDelegate::CreateUObject(this, &UEnemyShipRegistry::OnActorSpawned));
+}
+
+void UEnemyShipRegistry::Deinitialize()
+{
+    GetWorld()->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+    ActorSpawnedHandle.Reset();
+    EnemyShips.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UEnemyShipRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyShipRegistry::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Actors loaded with the level are not reported by the spawn handler
+    for (TActorIterator<AActor> It(&InWorld); It; ++It)
+    {
+        if (It->ActorHasTag(FName("EnemyShip")))
+        {
+            RegisterEnemyShip(*It);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("EnemyShipRegistry: %d enemy ships registered."), EnemyShips.Num());
+}
+
+void UEnemyShipRegistry::RegisterEnemyShip(AActor* EnemyShip)
+{
+    // The EndPlay binding doubles as the "already registered" check, which avoids searching the whole list
+    if (!EnemyShip || EnemyShip->OnEndPlay.IsAlreadyBound(this, &UEnemyShipRegistry::OnEnemyShipEndPlay))
+    {
+        return;
+    }
+
+    EnemyShip->OnEndPlay.AddDynamic(this, &UEnemyShipRegistry::OnEnemyShipEndPlay);
+    EnemyShips.Add(EnemyShip);
+}
+
+void UEnemyShipRegistry::OnActorSpawned(AActor* SpawnedActor)
+{
+    if (SpawnedActor && SpawnedActor->ActorHasTag(FName("EnemyShip")))
+    {
+        RegisterEnemyShip(SpawnedActor);
+    }
+}
+
+void UEnemyShipRegistry::OnEnemyShipEndPlay(AActor* EnemyShip, EEndPlayReason::Type EndPlayReason)
+{
+    EnemyShip->OnEndPlay.RemoveDynamic(this, &UEnemyShipRegistry::OnEnemyShipEndPlay);
+    EnemyShips.RemoveSingleSwap(EnemyShip);
+}
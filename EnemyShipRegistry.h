@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyShipRegistry.generated.h"
+
+// Keeps track of all actors tagged "EnemyShip" so that systems such as periscope auto-ranging
+// don't need to iterate over every actor in the world to find them.
+UCLASS()
+class SUBMARINESIM_API UEnemyShipRegistry : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Collects the enemy ships placed in the level, once per world
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    // Adds a ship that was not tagged as "EnemyShip" when it was spawned
+    UFUNCTION(BlueprintCallable, Category = "Enemy Ships")
+    void RegisterEnemyShip(AActor* EnemyShip);
+
+    // Ships are removed when they end play, which swaps the last ship into the removed ship's index
+    const TArray<TWeakObjectPtr<AActor>>& GetEnemyShips() const { return EnemyShips; }
+
+protected:
+    // Only game worlds have enemy ships to track
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    void OnActorSpawned(AActor* SpawnedActor);
+
+    UFUNCTION()
+    void OnEnemyShipEndPlay(AActor* EnemyShip, EEndPlayReason::Type EndPlayReason);
+
+    TArray<TWeakObjectPtr<AActor>> EnemyShips;
+
+    FDelegateHandle ActorSpawnedHandle;
+};
@@ -7,6 +7,8 @@
 #include "Camera/CameraComponent.h"
 #include "TorpedoLauncher.h"
 #include "EngineUtils.h"
+#include "HAL/PlatformTime.h"
+#include "EnemyShipRegistry.h"
 
 // Note: This code dynamically assigns TorpedoPipeButtons and TorpedoPipeTextBlocks because elements
 // assigned through Blueprints may be lost during compilation or edits due to a bug in Unreal Engine.
@@ -85,6 +87,12 @@ void UPeriscopeOverlayUI::NativeConstruct()
 		UE_LOG(LogTemp, Warning, TEXT("MeasureDistanceButton is not assigned!"));
     }
 
+    // The auto-range button is optional
+    if (AutoRangeButton)
+    {
+        AutoRangeButton->OnClicked.AddDynamic(this, &UPeriscopeOverlayUI::ToggleAutoRanging);
+    }
+
     // Clear the arrays to avoid duplicates if this is called more than once
     TorpedoPipeButtons.Empty();
     TorpedoPipeTextBlocks.Empty();
@@ -266,6 +274,255 @@ void UPeriscopeOverlayUI::MeasureDistance()
     }
 }
 
+// Continuous auto-ranging
+//
+// Instead of re-evaluating every ship each frame, the currently locked contact is tracked and only its range
+// is updated. Candidate selection over all ships is re-run only when the bore slews past AutoRangeReacquireAngle
+// or the lock is lost, and is time-sliced across frames so that it never exceeds AutoRangeBudgetMs.
+// The lens test is done as a view cone check in world space, which is equivalent to the screen space check
+// in MeasureDistance but avoids projecting every ship.
+
+void UPeriscopeOverlayUI::SetAutoRanging(bool bEnabled)
+{
+    if (bAutoRanging == bEnabled)
+    {
+        return;
+    }
+
+    bAutoRanging = bEnabled;
+    LockedEnemy.Reset();
+    bScanInProgress = false;
+    SelectionBoreDirection = FVector::ZeroVector;
+    DisplayedDistance = INDEX_NONE;
+
+    // The registry already knows all enemy ships, so enabling the mode doesn't have to search the world
+    UWorld* World = GetWorld();
+    EnemyShipRegistry = bAutoRanging && World ? World->GetSubsystem<UEnemyShipRegistry>() : nullptr;
+
+    UE_LOG(LogTemp, Log, TEXT("Auto-ranging %s."), bAutoRanging ? TEXT("enabled") : TEXT("disabled"));
+}
+
+void UPeriscopeOverlayUI::ToggleAutoRanging()
+{
+    SetAutoRanging(!bAutoRanging);
+}
+
+bool UPeriscopeOverlayUI::UpdateLensCone(FVector& OutCameraLocation, FVector& OutBoreDirection, float& OutCosHalfAngle) const
+{
+    if (!PeriscopeCamera || !GEngine || !GEngine->GameViewport)
+    {
+        return false;
+    }
+
+    FVector2D ViewportSize;
+    GEngine->GameViewport->GetViewportSize(ViewportSize);
+    if (ViewportSize.X <= 0.0f)
+    {
+        return false;
+    }
+
+    // Same 38% screen height threshold as in MeasureDistance, converted to an angle from the bore
+    const float ScreenHeightPercentageThreshold = 0.38f;
+    const float TanHalfFOV = FMath::Tan(FMath::DegreesToRadians(PeriscopeCamera->FieldOfView * 0.5f));
+    const float TanHalfAngle = ViewportSize.Y * ScreenHeightPercentageThreshold / (ViewportSize.X * 0.5f) * TanHalfFOV;
+
+    OutCameraLocation = PeriscopeCamera->GetComponentLocation();
+    OutBoreDirection = PeriscopeCamera->GetForwardVector();
+    OutCosHalfAngle = FMath::InvSqrt(1.0f + TanHalfAngle * TanHalfAngle);
+    return true;
+}
+
+bool UPeriscopeOverlayUI::IsWithinLens(const FVector& Location, const FVector& CameraLocation, const FVector& BoreDirection, float CosHalfAngle, float& OutDistanceSquared)
+{
+    const FVector ToTarget = Location - CameraLocation;
+    const float AlongBore = FVector::DotProduct(ToTarget, BoreDirection);
+    OutDistanceSquared = ToTarget.SizeSquared();
+
+    // Compare squared values to avoid a square root per contact
+    return AlongBore > 0.0f && AlongBore * AlongBore >= CosHalfAngle * CosHalfAngle * OutDistanceSquared;
+}
+
+void UPeriscopeOverlayUI::StartCandidateScan(const FVector& CameraLocation, const FVector& BoreDirection, float CosHalfAngle)
+{
+    // The cone is captured once so that all ships are compared against the same view, even if the scan spans several frames
+    bScanInProgress = true;
+    ScanIndex = 0;
+    ScanCameraLocation = CameraLocation;
+    ScanBoreDirection = BoreDirection;
+    ScanCosHalfAngle = CosHalfAngle;
+    ScanBestEnemy.Reset();
+    ScanBestDistanceSquared = FLT_MAX;
+}
+
+void UPeriscopeOverlayUI::ContinueCandidateScan(const FVector& CameraLocation, const FVector& BoreDirection, float CosHalfAngle, uint64 DeadlineCycles)
+{
+    if (!EnemyShipRegistry)
+    {
+        bScanInProgress = false;
+        return;
+    }
+
+    // Ships ending play are swap-removed from the registry, so a scan may miss a ship that moved to an already
+    // visited index. That ship is picked up by the next scan.
+    const TArray<TWeakObjectPtr<AActor>>& EnemyShips = EnemyShipRegistry->GetEnemyShips();
+
+    // Checking the clock is not free, so only do it every few contacts
+    const int32 ContactsPerTimeCheck = 64;
+
+    while (ScanIndex < EnemyShips.Num())
+    {
+        const int32 BatchEnd = FMath::Min(ScanIndex + ContactsPerTimeCheck, EnemyShips.Num());
+        for (; ScanIndex < BatchEnd; ++ScanIndex)
+        {
+            AActor* Enemy = EnemyShips[ScanIndex].Get();
+            if (!Enemy)
+            {
+                continue;
+            }
+
+            float DistanceSquared;
+            if (IsWithinLens(Enemy->GetActorLocation(), ScanCameraLocation, ScanBoreDirection, ScanCosHalfAngle, DistanceSquared)
+                && DistanceSquared < ScanBestDistanceSquared)
+            {
+                ScanBestDistanceSquared = DistanceSquared;
+                ScanBestEnemy = Enemy;
+            }
+        }
+
+        if (FPlatformTime::Cycles64() >= DeadlineCycles)
+        {
+            return;
+        }
+    }
+
+    bScanInProgress = false;
+    SelectionBoreDirection = ScanBoreDirection;
+    LastScanTime = GetWorld()->GetTimeSeconds();
+
+    // The winner was picked against the view at the start of the scan, so make sure it is still within the lens now
+    AActor* NewLock = ScanBestEnemy.Get();
+    float CurrentDistanceSquared = 0.0f;
+    if (NewLock && !IsWithinLens(NewLock->GetActorLocation(), CameraLocation, BoreDirection, CosHalfAngle, CurrentDistanceSquared))
+    {
+        NewLock = nullptr;
+    }
+
+    // Without a usable winner, keep the current lock. NativeTick has already confirmed it is within the current lens.
+    if (!NewLock)
+    {
+        if (!LockedEnemy.IsValid())
+        {
+            UE_LOG(LogTemp, Log, TEXT("Auto-ranging: no enemy ship found within the view of the PeriscopeCamera."));
+        }
+        return;
+    }
+
+    if (NewLock != LockedEnemy.Get())
+    {
+        LockedEnemy = NewLock;
+
+        // Start from the current range of the new contact instead of blending from the previous one
+        SmoothedRange = FMath::Sqrt(CurrentDistanceSquared);
+        UE_LOG(LogTemp, Log, TEXT("Auto-ranging locked on enemy ship '%s'."), *NewLock->GetName());
+    }
+}
+
+void UPeriscopeOverlayUI::SetDisplayedDistance(int32 DistanceInMeters)
+{
+    // Only touch the text box when the displayed value actually changes
+    if (!DistanceInput || DistanceInMeters == DisplayedDistance)
+    {
+        return;
+    }
+
+    FText FormattedDistanceText = FText::FromString(FString::Printf(TEXT("%d"), DistanceInMeters));
+
+    bWritingDisplayedDistance = true;
+    DistanceInput->SetText(FormattedDistanceText);
+    OnDistanceInputChanged(FormattedDistanceText);
+    bWritingDisplayedDistance = false;
+
+    DisplayedDistance = DistanceInMeters;
+}
+
+void UPeriscopeOverlayUI::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+    Super::NativeTick(MyGeometry, InDeltaTime);
+
+    if (!bAutoRanging)
+    {
+        return;
+    }
+
+    const double BudgetSeconds = FMath::Clamp(AutoRangeBudgetMs, 0.0f, 0.1f) / 1000.0;
+    const uint64 DeadlineCycles = FPlatformTime::Cycles64() + static_cast<uint64>(BudgetSeconds / FPlatformTime::GetSecondsPerCycle64());
+
+    FVector CameraLocation;
+    FVector BoreDirection;
+    float CosHalfAngle;
+    if (!UpdateLensCone(CameraLocation, BoreDirection, CosHalfAngle))
+    {
+        return;
+    }
+
+    // Keep tracking the locked contact as long as it stays within the lens
+    bool bLockLost = false;
+    float LockedDistanceSquared = 0.0f;
+    AActor* Locked = LockedEnemy.Get();
+    if (LockedEnemy.IsStale() || (Locked && !IsWithinLens(Locked->GetActorLocation(), CameraLocation, BoreDirection, CosHalfAngle, LockedDistanceSquared)))
+    {
+        UE_LOG(LogTemp, Log, TEXT("Auto-ranging lost lock on enemy ship."));
+        LockedEnemy.Reset();
+        Locked = nullptr;
+        bLockLost = true;
+
+        // Don't keep showing the range of a ship that is no longer in view while a new one is searched for
+        SetDisplayedDistance(0);
+    }
+
+    // Re-run candidate selection only if the lock is lost or the bore has slewed far enough.
+    // With nothing in view, the scan is also repeated every AutoRangeRepollInterval to pick up ships sailing into the lens.
+    if (!bScanInProgress)
+    {
+        const bool bBoreMoved = FVector::DotProduct(BoreDirection, SelectionBoreDirection) < FMath::Cos(FMath::DegreesToRadians(AutoRangeReacquireAngle));
+        const bool bRepollDue = !Locked && GetWorld()->GetTimeSeconds() - LastScanTime >= AutoRangeRepollInterval;
+        if (bLockLost || bBoreMoved || bRepollDue)
+        {
+            StartCandidateScan(CameraLocation, BoreDirection, CosHalfAngle);
+        }
+    }
+
+    if (bScanInProgress)
+    {
+        ContinueCandidateScan(CameraLocation, BoreDirection, CosHalfAngle, DeadlineCycles);
+
+        // The scan may have switched to a different contact
+        if (LockedEnemy.Get() != Locked)
+        {
+            Locked = LockedEnemy.Get();
+            if (Locked)
+            {
+                LockedDistanceSquared = FVector::DistSquared(Locked->GetActorLocation(), CameraLocation);
+            }
+        }
+    }
+
+    if (Locked)
+    {
+        // Exponential smoothing, independent of the frame rate
+        const float Alpha = AutoRangeSmoothingTime > 0.0f ? 1.0f - FMath::Exp(-InDeltaTime / AutoRangeSmoothingTime) : 1.0f;
+        SmoothedRange = FMath::Lerp(SmoothedRange, FMath::Sqrt(LockedDistanceSquared), Alpha);
+
+        // Convert the distance to meters
+        SetDisplayedDistance(FMath::RoundToInt(SmoothedRange / 100.0f));
+    }
+    else
+    {
+        // Nothing within the lens, same as MeasureDistance
+        SetDisplayedDistance(0);
+    }
+}
+
 // Method for handling button clicks
 void UPeriscopeOverlayUI::OnTorpedoPipeButtonClicked()
 {
@@ -326,6 +583,12 @@ void UPeriscopeOverlayUI::SelectTorpedoPipe(int PipeIndex)
 
 void UPeriscopeOverlayUI::OnDistanceInputChanged(const FText& Text)
 {    
+    // The operator or MeasureDistance changed the field, so auto-ranging has to rewrite it on its next update
+    if (!bWritingDisplayedDistance)
+    {
+        DisplayedDistance = INDEX_NONE;
+    }
+
     float Distance = FCString::Atof(*Text.ToString());
     if (Distance > 5000.0f)
     {
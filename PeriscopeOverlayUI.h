@@ -11,6 +11,7 @@ class UButton;
 class UTextBlock;
 class UEditableTextBox;
 class UTorpedoLauncher;
+class UEnemyShipRegistry;
 
 UCLASS()
 class SUBMARINESIM_API UPeriscopeOverlayUI : public UUserWidget
@@ -32,6 +33,26 @@ public:
     UPROPERTY(meta = (BindWidget))
     UButton* LaunchButton;
 
+    // Toggles continuous auto-ranging (optional, the mode can also be toggled from Blueprints)
+    UPROPERTY(meta = (BindWidgetOptional))
+    UButton* AutoRangeButton;
+
+    // Per-frame time budget for continuous ranging, in milliseconds (at most 0.1 ms)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Periscope|Auto Ranging", meta = (ClampMin = "0", ClampMax = "0.1"))
+    float AutoRangeBudgetMs = 0.08f;
+
+    // How far the bore has to slew (in degrees) before candidate selection is re-run
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Periscope|Auto Ranging")
+    float AutoRangeReacquireAngle = 2.0f;
+
+    // Time constant of the range smoothing filter, in seconds
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Periscope|Auto Ranging")
+    float AutoRangeSmoothingTime = 0.5f;
+
+    // How often candidate selection is re-run while no ship is locked and the bore is still, in seconds
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Periscope|Auto Ranging", meta = (ClampMin = "0"))
+    float AutoRangeRepollInterval = 0.25f;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Torpedo Pipes", meta = (AllowPrivateAccess = "true"))
     TArray<UButton*> TorpedoPipeButtons;
 
@@ -44,6 +65,13 @@ public:
     UFUNCTION()
     void OnDistanceInputChanged(const FText& Text);
 
+    // Enables or disables continuous auto-ranging
+    UFUNCTION(BlueprintCallable, Category = "Periscope")
+    void SetAutoRanging(bool bEnabled);
+
+    UFUNCTION()
+    void ToggleAutoRanging();
+
     // Function to select a torpedo pipe
     UFUNCTION()
     void SelectTorpedoPipe(int PipeIndex);
@@ -58,11 +86,50 @@ protected:
     // Called when the widget is constructed
     virtual void NativeConstruct() override;
 
+    // Drives continuous auto-ranging
+    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
     // Function called when a torpedo pipe button is clicked
     UFUNCTION()
     void OnTorpedoPipeButtonClicked();
 
 private:
+    // Continuous ranging helpers
+    bool UpdateLensCone(FVector& OutCameraLocation, FVector& OutBoreDirection, float& OutCosHalfAngle) const;
+    void StartCandidateScan(const FVector& CameraLocation, const FVector& BoreDirection, float CosHalfAngle);
+    void ContinueCandidateScan(const FVector& CameraLocation, const FVector& BoreDirection, float CosHalfAngle, uint64 DeadlineCycles);
+    void SetDisplayedDistance(int32 DistanceInMeters);
+
+    // Returns true if Location is within the lens cone, along with its squared distance from the camera
+    static bool IsWithinLens(const FVector& Location, const FVector& CameraLocation, const FVector& BoreDirection, float CosHalfAngle, float& OutDistanceSquared);
+
+    // Enemy ships are looked up from the registry instead of iterating the whole world
+    UPROPERTY()
+    UEnemyShipRegistry* EnemyShipRegistry;
+
+    bool bAutoRanging = false;
+
+    // Contact currently tracked between frames
+    TWeakObjectPtr<AActor> LockedEnemy;
+
+    // Bore direction and world time of the last completed candidate selection
+    FVector SelectionBoreDirection = FVector::ZeroVector;
+    double LastScanTime = 0.0;
+
+    // Candidate selection state, spread over several frames when the budget runs out
+    bool bScanInProgress = false;
+    int32 ScanIndex = 0;
+    FVector ScanCameraLocation = FVector::ZeroVector;
+    FVector ScanBoreDirection = FVector::ZeroVector;
+    float ScanCosHalfAngle = 1.0f;
+    TWeakObjectPtr<AActor> ScanBestEnemy;
+    float ScanBestDistanceSquared = FLT_MAX;
+
+    // Smoothed range in UE units, and the last value written to DistanceInput
+    float SmoothedRange = 0.0f;
+    int32 DisplayedDistance = INDEX_NONE;
+    bool bWritingDisplayedDistance = false;
+
     // Boolean array to keep track of selected pipes
     TArray<bool> TorpedoPipesSelected;
 